@@ -0,0 +1,141 @@
+#include "date_label.h"
+
+// Layout of the label. 'D' is a digit cell, '-' a separator cell
+static const char DATE_LABEL_FORMAT[] = "DDDD-DD-DD";
+#define DATE_LABEL_LENGTH (sizeof(DATE_LABEL_FORMAT) - 1)
+
+// Glyph strip layout in IMAGE_DATE_GLYPHS: digits 0-9 in fixed width cells followed by the separator
+#define DIGIT_WIDTH 9
+#define SEPARATOR_WIDTH 6
+#define GLYPH_HEIGHT 14
+
+#define GLYPH_SEPARATOR 10
+#define GLYPH_COUNT 11
+#define GLYPH_NONE 0xFF
+
+/**
+ * Represents a date label drawn from pre-rendered glyph bitmaps
+ */
+struct DateLabel
+{
+    Layer *layer;
+    GBitmap *glyph_strip;
+    GBitmap *glyphs[GLYPH_COUNT];
+    uint8_t cells[DATE_LABEL_LENGTH];
+    int16_t origin_x;
+};
+
+/**
+ * Get the width of a cell in the label layout
+ * @param index Index of the cell in DATE_LABEL_FORMAT
+ */
+static int16_t cell_width(int index)
+{
+    return DATE_LABEL_FORMAT[index] == 'D' ? DIGIT_WIDTH : SEPARATOR_WIDTH;
+}
+
+/**
+ * Draw every cell of the label from the glyph cache
+ * @param layer The date label layer
+ * @param context Graphics context to draw the glyphs with
+ */
+static void layer_update_date_label(Layer *layer, GContext *context)
+{
+    DateLabel *date_label = *(DateLabel **)layer_get_data(layer);
+    int16_t x = date_label->origin_x;
+    int16_t y = (layer_get_bounds(layer).size.h - GLYPH_HEIGHT) / 2;
+
+    graphics_context_set_compositing_mode(context, GCompOpSet);
+    for (unsigned int i = 0; i < DATE_LABEL_LENGTH; i++)
+    {
+        int16_t width = cell_width(i);
+        if (date_label->cells[i] < GLYPH_COUNT)
+            graphics_draw_bitmap_in_rect(context, date_label->glyphs[date_label->cells[i]],
+                                         GRect(x, y, width, GLYPH_HEIGHT));
+        x += width;
+    }
+}
+
+/**
+ * Create a date label, cutting the glyph strip resource into one sub-bitmap per glyph
+ * @param frame Frame of the label. The date is centered within it
+ */
+DateLabel *date_label_create(GRect frame)
+{
+    DateLabel *date_label = malloc(sizeof(DateLabel));
+    date_label->glyph_strip = gbitmap_create_with_resource(RESOURCE_ID_IMAGE_DATE_GLYPHS);
+
+    for (int glyph = 0; glyph < GLYPH_SEPARATOR; glyph++)
+        date_label->glyphs[glyph] =
+            gbitmap_create_as_sub_bitmap(date_label->glyph_strip, GRect(glyph * DIGIT_WIDTH, 0, DIGIT_WIDTH, GLYPH_HEIGHT));
+    date_label->glyphs[GLYPH_SEPARATOR] = gbitmap_create_as_sub_bitmap(
+        date_label->glyph_strip, GRect(GLYPH_SEPARATOR * DIGIT_WIDTH, 0, SEPARATOR_WIDTH, GLYPH_HEIGHT));
+
+    int16_t width = 0;
+    for (unsigned int i = 0; i < DATE_LABEL_LENGTH; i++)
+    {
+        date_label->cells[i] = GLYPH_NONE;
+        width += cell_width(i);
+    }
+    date_label->origin_x = (frame.size.w - width) / 2;
+
+    date_label->layer = layer_create_with_data(frame, sizeof(DateLabel *));
+    *(DateLabel **)layer_get_data(date_label->layer) = date_label;
+    layer_set_update_proc(date_label->layer, layer_update_date_label);
+
+    return date_label;
+}
+
+/**
+ * Destroy a date label and its glyph cache
+ * @param date_label The date label to destroy
+ */
+void date_label_destroy(DateLabel *date_label)
+{
+    layer_destroy(date_label->layer);
+
+    for (int glyph = 0; glyph < GLYPH_COUNT; glyph++)
+        gbitmap_destroy(date_label->glyphs[glyph]);
+    gbitmap_destroy(date_label->glyph_strip);
+
+    free(date_label);
+}
+
+/**
+ * Get the layer of a date label to add it to a window
+ * @param date_label The date label whose layer to return
+ */
+Layer *date_label_get_layer(DateLabel *date_label)
+{
+    return date_label->layer;
+}
+
+/**
+ * Show the given date. The digits are filled into DATE_LABEL_FORMAT right to left from YYYYMMDD
+ * @param date_label The date label to update
+ * @param time_info The date to show
+ */
+void date_label_set_date(DateLabel *date_label, struct tm *time_info)
+{
+    int32_t digits = (time_info->tm_year + 1900) * 10000 + (time_info->tm_mon + 1) * 100 + time_info->tm_mday;
+    bool changed = false;
+
+    for (int i = DATE_LABEL_LENGTH - 1; i >= 0; i--)
+    {
+        uint8_t glyph = GLYPH_SEPARATOR;
+        if (DATE_LABEL_FORMAT[i] == 'D')
+        {
+            glyph = digits % 10;
+            digits /= 10;
+        }
+
+        if (date_label->cells[i] != glyph)
+        {
+            date_label->cells[i] = glyph;
+            changed = true;
+        }
+    }
+
+    if (changed)
+        layer_mark_dirty(date_label->layer);
+}
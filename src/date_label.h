@@ -0,0 +1,9 @@
+#pragma once
+#include "pebble.h"
+
+typedef struct DateLabel DateLabel;
+
+DateLabel *date_label_create(GRect frame);
+void date_label_destroy(DateLabel *date_label);
+Layer *date_label_get_layer(DateLabel *date_label);
+void date_label_set_date(DateLabel *date_label, struct tm *time_info);
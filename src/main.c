@@ -4,15 +4,12 @@
 #define NEXT_STEP_DELAY 300
 
 /**
- * Update the date display text
+ * Update the date display
  */
 static void update_date_display()
 {
-    static char date_buffer[32];
     struct tm *time_info = localtime(&simulation_time);
-    snprintf(date_buffer, sizeof(date_buffer), "%04d-%02d-%02d", time_info->tm_year + 1900, time_info->tm_mon + 1,
-             time_info->tm_mday);
-    text_layer_set_text(date_layer, date_buffer);
+    date_label_set_date(date_label, time_info);
 }
 
 /**
@@ -125,6 +122,8 @@ static void select_click_handler(ClickRecognizerRef recognizer, void *context)
 static void up_long_click_handler(ClickRecognizerRef recognizer, void *context)
 {
     step_direction = 1;
+    set_accuracy_tier(ACCURACY_FAST);
+
     // Cancel existing timer
     if (step_timer)
         app_timer_cancel(step_timer);
@@ -139,6 +138,7 @@ static void up_long_click_handler(ClickRecognizerRef recognizer, void *context)
 static void down_long_click_handler(ClickRecognizerRef recognizer, void *context)
 {
     step_direction = -1;
+    set_accuracy_tier(ACCURACY_FAST);
 
     // Cancel existing timer
     if (step_timer)
@@ -149,7 +149,7 @@ static void down_long_click_handler(ClickRecognizerRef recognizer, void *context
 }
 
 /**
- * Button release handler - stop continuous stepping
+ * Button release handler - stop continuous stepping and redraw with the precise tier
  */
 static void button_release_handler(ClickRecognizerRef recognizer, void *context)
 {
@@ -159,6 +159,10 @@ static void button_release_handler(ClickRecognizerRef recognizer, void *context)
         app_timer_cancel(step_timer);
         step_timer = NULL;
     }
+
+    set_accuracy_tier(ACCURACY_PRECISE);
+    struct tm *time_info = localtime(&simulation_time);
+    update_planet_positions(time_info);
 }
 
 /**
@@ -191,13 +195,9 @@ static void main_window_load(Window *window)
     load_solar_system(background);
     layer_add_to_window(background, window);
 
-    // Create date text layer at top of screen
-    date_layer = text_layer_create(GRect(0, 5, bounds.size.w, 30));
-    text_layer_set_background_color(date_layer, GColorClear);
-    text_layer_set_text_color(date_layer, GColorWhite);
-    text_layer_set_text_alignment(date_layer, GTextAlignmentCenter);
-    text_layer_set_font(date_layer, fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD));
-    layer_add_child(window_get_root_layer(window), text_layer_get_layer(date_layer));
+    // Create date label at top of screen
+    date_label = date_label_create(GRect(0, 5, bounds.size.w, 30));
+    layer_add_child(window_get_root_layer(window), date_label_get_layer(date_label));
 
     // Initialize simulation time to current time
     simulation_time = time(NULL);
@@ -213,7 +213,7 @@ static void main_window_load(Window *window)
  */
 static void main_window_unload(Window *window)
 {
-    text_layer_destroy(date_layer);
+    date_label_destroy(date_label);
     layer_destroy(background);
 }
 
@@ -1,4 +1,5 @@
 #include "planets.h"
+#include "date_label.h"
 
 // Time limits to prevent overflow
 // Max: Jan 19, 2038, Min: Jan 1, 1970 (Unix epoch)
@@ -7,7 +8,7 @@
 
 static Window *main_window;
 static Layer *background;
-static TextLayer *date_layer;
+static DateLabel *date_label;
 
 static AppTimer *timer = NULL;
 static AppTimer *step_timer = NULL;
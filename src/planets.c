@@ -2,6 +2,22 @@
 #include "@pebble-libraries/pbl-math/pbl-math.h"
 #include "@pebble-libraries/pbl-display/pbl-display.h"
 
+// Number of Newton iterations used by the precise tier. Starting from M + e*sin(M), one step keeps the
+// true anomaly within ~0.02 degrees for Mercury (e = 0.2056), well under the whole degree the result
+// is truncated to. Further steps make no visible difference
+#define KEPLER_ITERATIONS 1
+
+// Draw orbits in the precise tier as ellipses with the sun at a focus. Remove to keep the
+// precise angles on circular orbits
+#define ELLIPTICAL_ORBITS
+
+// 1.0 in Q16 fixed point. Matches TRIG_MAX_ANGLE and is within one LSB of TRIG_MAX_RATIO, the range of
+// sin_lookup/cos_lookup
+#define FIXED_ONE 65536
+
+// Convert a Q16 value in radians to a trig angle (multiply by TRIG_MAX_ANGLE / 2π)
+#define FIXED_RAD_TO_TRIGANGLE(x) ((int32_t)(((int64_t)(x) * 10430) >> 16))
+
 /**
  * Represents a planet layer with coordinates on the screen
  */
@@ -16,6 +32,10 @@ typedef struct
     int position_epoch;
     double eccentricity;
     int perihelion;
+    int32_t mean_anomaly_epoch;
+    int32_t angular_rate_fixed;
+    int32_t eccentricity_fixed;
+    int32_t minor_axis_fixed;
 } PlanetLayer;
 
 /**
@@ -40,6 +60,20 @@ typedef struct
  */
 SolarSystemLayer *solar_system = NULL;
 
+/**
+ * Accuracy tier used when calculating planet angles
+ */
+static ACCURACY_TIER accuracy_tier = ACCURACY_PRECISE;
+
+/**
+ * Set the accuracy tier used for subsequent planet position updates
+ * @param tier ACCURACY_FAST while scrubbing through time, ACCURACY_PRECISE otherwise
+ */
+void set_accuracy_tier(ACCURACY_TIER tier)
+{
+    accuracy_tier = tier;
+}
+
 /**
  * Get the color of a given planet based on given PLANET enum. Always white if PBL_BW
  * @param planet Enum of PLANET representing the planet color to return
@@ -136,16 +170,115 @@ int32_t days_since_epoch(int year, int month, int day)
 }
 
 /**
- * Calculate angular position of a planet at given days from epoch
+ * Integer square root of a 64 bit value, rounded down
+ * @param value Value to take the square root of
+ */
+static uint32_t isqrt64(uint64_t value)
+{
+    uint64_t result = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > value)
+        bit >>= 2;
+
+    while (bit != 0)
+    {
+        if (value >= result + bit)
+        {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        }
+        else
+        {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)result;
+}
+
+/**
+ * Precompute the fixed-point orbital constants used by the precise tier
+ * @param planet_layer The PlanetLayer whose eccentricity has been set
+ */
+static void init_planet_orbit(PlanetLayer *planet_layer)
+{
+    // Mean anomaly at the epoch and its change per day, both as trig angles
+    planet_layer->mean_anomaly_epoch = DEG_TO_TRIGANGLE(planet_layer->position_epoch - planet_layer->perihelion + 360);
+    planet_layer->angular_rate_fixed =
+        planet_layer->period_days > 0.0 ? (int32_t)((double)TRIG_MAX_ANGLE * FIXED_ONE / planet_layer->period_days) : 0;
+
+    planet_layer->eccentricity_fixed = (int32_t)(planet_layer->eccentricity * FIXED_ONE);
+
+    // b/a = sqrt(1 - e^2), taken in Q32 so the root comes out in Q16
+    int64_t e_squared = (int64_t)planet_layer->eccentricity_fixed * planet_layer->eccentricity_fixed;
+    planet_layer->minor_axis_fixed = (int32_t)isqrt64(((uint64_t)FIXED_ONE * FIXED_ONE) - e_squared);
+}
+
+/**
+ * Solve Kepler's equation (M = E - e*sin(E)) for the true anomaly using fixed-point Newton iterations
+ * @param planet_layer The PlanetLayer to solve for
+ * @param mean Mean anomaly as a trig angle
+ * @param radius Set to the orbit radius in Q16 pixels
+ * @return True anomaly in degrees
+ */
+static int solve_true_anomaly(PlanetLayer *planet_layer, int32_t mean, int32_t *radius)
+{
+    int32_t e = planet_layer->eccentricity_fixed;
+
+    // E0 = M + e*sin(M)
+    int32_t eccentric = mean + FIXED_RAD_TO_TRIGANGLE(((int64_t)e * sin_lookup(mean)) >> 16);
+    int32_t sin_e = sin_lookup(eccentric);
+    int32_t cos_e = cos_lookup(eccentric);
+
+    // E(n+1) = E(n) - (E(n) - e*sin(E(n)) - M) / (1 - e*cos(E(n)))
+    for (int i = 0; i < KEPLER_ITERATIONS; i++)
+    {
+        int32_t error = eccentric - FIXED_RAD_TO_TRIGANGLE(((int64_t)e * sin_e) >> 16) - mean;
+        int32_t slope = FIXED_ONE - (int32_t)(((int64_t)e * cos_e) >> 16);
+        eccentric -= (int32_t)(((int64_t)error * FIXED_ONE) / slope);
+        sin_e = sin_lookup(eccentric);
+        cos_e = cos_lookup(eccentric);
+    }
+
+#ifdef ELLIPTICAL_ORBITS
+    // r = a(1 - e*cos(E))
+    *radius = planet_layer->fake_orbit * (FIXED_ONE - (int32_t)(((int64_t)e * cos_e) >> 16));
+#else
+    *radius = planet_layer->fake_orbit * FIXED_ONE;
+#endif
+
+    // ν = atan2(sqrt(1 - e^2)*sin(E), cos(E) - e). Shifted down to fit atan2_lookup's int16 arguments
+    int32_t y = (int32_t)(((int64_t)planet_layer->minor_axis_fixed * sin_e) >> 16);
+    int32_t x = cos_e - e;
+    int32_t true_anomaly = atan2_lookup((int16_t)(y >> 2), (int16_t)(x >> 2));
+
+    return TRIGANGLE_TO_DEG(true_anomaly);
+}
+
+/**
+ * Calculate angular position of a planet at given days from epoch using the current accuracy tier
  * @param planet Enum value of planet to determine angle for
  * @param days Days since the epoch to determine current angle from
+ * @param radius Set to the distance of the planet from the sun in Q16 pixels
  */
-int calculate_planet_angle(PLANET planet, double days)
+int calculate_planet_angle(PLANET planet, double days, int32_t *radius)
 {
     PlanetLayer *planet_layer = get_planet_layer_from_planet(planet);
     if (!planet_layer)
         return -1;
 
+    // P + ν
+    // Precise tier: integer mean anomaly, then rotate the solved true anomaly back into the watch face reference frame
+    if (accuracy_tier == ACCURACY_PRECISE)
+    {
+        int32_t travelled = (int32_t)(((int64_t)(int32_t)days * planet_layer->angular_rate_fixed) >> 16);
+        int32_t mean = (planet_layer->mean_anomaly_epoch - travelled) & (TRIG_MAX_ANGLE - 1);
+        return (planet_layer->perihelion + solve_true_anomaly(planet_layer, mean, radius)) % 360;
+    }
+
+    *radius = planet_layer->fake_orbit * FIXED_ONE;
     float scale = 1.0f / 1024.0f;
 
     // Calculating formula:  θ ≈ R + 2e*sin(M) (derived from Kepler's Equation: θ ≈ M + 2e*sin(M))
@@ -173,28 +306,31 @@ int calculate_planet_angle(PLANET planet, double days)
 /**
  * Function to update planet positions based on angle for a given PlanetLayer
  * @param planet_layer The PlanetLayer to update
- * @param angle Angle at which the planet should sit on its orbital circle
+ * @param angle Angle at which the planet should sit on its orbit
+ * @param radius Distance of the planet from the sun in Q16 pixels
  */
-void update_planet_layer_position(PlanetLayer *planet_layer, int angle)
+void update_planet_layer_position(PlanetLayer *planet_layer, int angle, int32_t radius)
 {
     float scale = 1.0f / 1024.0f;
+    float orbit = (float)radius / FIXED_ONE;
 
-    planet_layer->x = DISPLAY_CENTER_X + (int)(planet_layer->fake_orbit * pbl_cos_sin_deg(angle) * scale);
-    planet_layer->y = DISPLAY_CENTER_Y + (int)(planet_layer->fake_orbit * pbl_int_sin_deg(angle) * scale);
+    planet_layer->x = DISPLAY_CENTER_X + (int)(orbit * pbl_cos_sin_deg(angle) * scale);
+    planet_layer->y = DISPLAY_CENTER_Y + (int)(orbit * pbl_int_sin_deg(angle) * scale);
 }
 
 /**
  * Function to update planet positions based on angle for a given PLANET enum value
  * @param planet PLANET enum value representing the PlanetLayer to update
- * @param angle Angle at which the planet should sit on its orbital circle
+ * @param angle Angle at which the planet should sit on its orbit
+ * @param radius Distance of the planet from the sun in Q16 pixels
  */
-void update_planet_position(PLANET planet, int angle)
+void update_planet_position(PLANET planet, int angle, int32_t radius)
 {
     PlanetLayer *planet_layer = get_planet_layer_from_planet(planet);
     if (!planet_layer)
         return;
 
-    update_planet_layer_position(planet_layer, angle);
+    update_planet_layer_position(planet_layer, angle, radius);
 }
 
 /**
@@ -204,14 +340,12 @@ void update_planet_position(PLANET planet, int angle)
 void update_planet_positions(tm *time)
 {
     double days = days_since_epoch(time->tm_year + 1900, time->tm_mon + 1, time->tm_mday);
-    update_planet_position(MERCURY, calculate_planet_angle(MERCURY, days));
-    update_planet_position(VENUS, calculate_planet_angle(VENUS, days));
-    update_planet_position(EARTH, calculate_planet_angle(EARTH, days));
-    update_planet_position(MARS, calculate_planet_angle(MARS, days));
-    update_planet_position(JUPITER, calculate_planet_angle(JUPITER, days));
-    update_planet_position(SATURN, calculate_planet_angle(SATURN, days));
-    update_planet_position(URANUS, calculate_planet_angle(URANUS, days));
-    update_planet_position(NEPTUNE, calculate_planet_angle(NEPTUNE, days));
+    for (PLANET planet = MERCURY; planet <= NEPTUNE; planet++)
+    {
+        int32_t radius;
+        int angle = calculate_planet_angle(planet, days, &radius);
+        update_planet_position(planet, angle, radius);
+    }
 
     if (solar_system->background)
         layer_mark_dirty(solar_system->background);
@@ -267,6 +401,7 @@ void load_solar_system(Layer *layer)
     sun->position_epoch = 0;
     sun->eccentricity = 0.0;
     sun->perihelion = 0;
+    init_planet_orbit(sun);
     solar_system->sun = sun;
 
     // Mercury
@@ -280,6 +415,7 @@ void load_solar_system(Layer *layer)
     mercury->position_epoch = 180;
     mercury->eccentricity = 0.2056;
     mercury->perihelion = 226;
+    init_planet_orbit(mercury);
     solar_system->mercury = mercury;
 
     // Venus
@@ -293,6 +429,7 @@ void load_solar_system(Layer *layer)
     venus->position_epoch = 185;
     venus->eccentricity = 0.0068;
     venus->perihelion = 280;
+    init_planet_orbit(venus);
     solar_system->venus = venus;
 
     // Earth
@@ -306,6 +443,7 @@ void load_solar_system(Layer *layer)
     earth->position_epoch = 180;
     earth->eccentricity = 0.0167;
     earth->perihelion = 252;
+    init_planet_orbit(earth);
     solar_system->earth = earth;
 
     // Mars
@@ -319,6 +457,7 @@ void load_solar_system(Layer *layer)
     mars->position_epoch = 205;
     mars->eccentricity = 0.0934;
     mars->perihelion = 125;
+    init_planet_orbit(mars);
     solar_system->mars = mars;
 
     // Jupiter
@@ -332,6 +471,7 @@ void load_solar_system(Layer *layer)
     jupiter->position_epoch = 260;
     jupiter->eccentricity = 0.0489;
     jupiter->perihelion = 163;
+    init_planet_orbit(jupiter);
     solar_system->jupiter = jupiter;
 
     // Saturn
@@ -345,6 +485,7 @@ void load_solar_system(Layer *layer)
     saturn->position_epoch = 5;
     saturn->eccentricity = 0.0542;
     saturn->perihelion = 241;
+    init_planet_orbit(saturn);
     solar_system->saturn = saturn;
 
     // Uranus
@@ -358,6 +499,7 @@ void load_solar_system(Layer *layer)
     uranus->position_epoch = 300;
     uranus->eccentricity = 0.0472;
     uranus->perihelion = 319;
+    init_planet_orbit(uranus);
     solar_system->uranus = uranus;
 
     // Neptune
@@ -371,6 +513,7 @@ void load_solar_system(Layer *layer)
     neptune->position_epoch = 355;
     neptune->eccentricity = 0.0086;
     neptune->perihelion = 193;
+    init_planet_orbit(neptune);
     solar_system->neptune = neptune;
 
     solar_system->background = layer;
@@ -12,9 +12,28 @@ typedef enum
     NEPTUNE
 } PLANET;
 
+/**
+ * Accuracy tiers for planet positioning. Cycle costs have not been measured on hardware or the
+ * emulator yet; the fixed worst-case work per planet is listed instead. The Cortex-M3/M4 watches
+ * have no double precision FPU, so every double op is a soft-float call
+ * ACCURACY_FAST    - M + 2e*sin(M) on a circular orbit. Soft-float: 2 divides, 5 multiplies and
+ *                    3 pbl_fmod calls plus adds and conversions. 1 sine lookup
+ * ACCURACY_PRECISE - Kepler's equation solved with 1 fixed-point Newton step on an elliptical
+ *                    orbit. 1 soft-float double to int conversion of the day count, then
+ *                    integer only: 5 sin/cos lookups, 1 atan2 lookup, 1 64-bit divide and
+ *                    9 64-bit multiplies, one of which compiles to a shift
+ * Both tiers then place the planet with 2 sine lookups, 1 float divide and 4 float multiplies
+ */
+typedef enum
+{
+    ACCURACY_FAST,
+    ACCURACY_PRECISE
+} ACCURACY_TIER;
+
+void set_accuracy_tier(ACCURACY_TIER tier);
 void update_planet_positions(tm *time);
 void update_planet_positions_now();
-void update_planet_position(PLANET planet, int angle);
+void update_planet_position(PLANET planet, int angle, int32_t radius);
 void load_solar_system(Layer *layer);
 void unload_solar_system(Layer *layer);
 void init_solar_system();
\ No newline at end of file